@@ -23,6 +23,9 @@
 # NETCDF_INCDIR  NetCDF include directory
 # NETCDF_LIBDIR  NetCDF library directory
 # NETCDF_LIBS    NetCDF library switches
+# PAPI_DIR       PAPI hardware counters library root directory
+# PAPI_INCDIR    PAPI include directory
+# PAPI_LIBDIR    PAPI library directory
 
 # LD             Program to load the objects into an executable or shared library
 # LDFLAGS        Flags to the loader
@@ -184,6 +187,15 @@ ifdef USE_ARPACK
              LIBS += -L$(ARPACK_LIBDIR) -larpack
 endif
 
+ifdef USE_PAPI
+         PAPI_DIR ?= /usr/local/papi
+      PAPI_INCDIR ?= $(PAPI_DIR)/include
+      PAPI_LIBDIR ?= $(PAPI_DIR)/lib
+           FFLAGS += -I$(PAPI_INCDIR)
+             LIBS += -L$(PAPI_LIBDIR) -lpapi
+           INCDIR += $(PAPI_INCDIR) $(INCDIR)
+endif
+
 ifdef USE_MPI
        MCT_LIBDIR ?= c:\\work\\models\\MCT_v2.2\\mct
       MPEU_LIBDIR ?= c:\\work\\models\\MCT_v2.2\\mpeu
@@ -22,6 +22,9 @@
 # NETCDF_INCDIR  NetCDF include directory
 # NETCDF_LIBDIR  NetCDF library directory
 # NETCDF_LIBS    NetCDF library switches
+# PAPI_DIR       PAPI hardware counters library root directory
+# PAPI_INCDIR    PAPI include directory
+# PAPI_LIBDIR    PAPI library directory
 # PIO_INCDIR     Parallel-IO (PIO) from SCORPIO library include directory
 # PIO_LIBDIR     Parallel-IO (PIO) from SCORPIO libary directory
 # PIO_LIBS       Parallel-IO (PIO) from SCORPIO library switches
@@ -238,6 +241,15 @@ ifdef USE_ARPACK
  endif
 endif
 
+ifdef USE_PAPI
+         PAPI_DIR ?= /usr/local/papi
+      PAPI_INCDIR ?= $(PAPI_DIR)/include
+      PAPI_LIBDIR ?= $(PAPI_DIR)/lib
+           FFLAGS += -I$(PAPI_INCDIR)
+             LIBS += -L$(PAPI_LIBDIR) -lpapi
+           INCDIR += $(PAPI_INCDIR) $(INCDIR)
+endif
+
 ifdef USE_MPI
          CPPFLAGS += -DMPI
  ifdef USE_MPIF90
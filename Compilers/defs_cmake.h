@@ -10,7 +10,7 @@
 **                                                                           **
 ** This file is used by CMake to determine whether additional models         **
 ** (adjoint, tangent, an representer) should be enabled. It also checks      **
-** if the ARPACK library is needed.                                          **
+** if the ARPACK and PAPI libraries are needed.                              **
 **                                                                           **
 *******************************************************************************
 */
@@ -210,6 +210,15 @@ SCORPIO
 #define FOUND
 #endif
 
+/*
+** Determine if the PAPI hardware counters library is needed.
+*/
+
+#ifdef PROFILE_PAPI
+PAPI
+#define FOUND
+#endif
+
 #ifndef FOUND
 NONE
 #endif
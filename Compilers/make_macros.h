@@ -160,3 +160,13 @@
 #else
   USE_ESMF :=
 #endif
+
+/*
+** Determine if the PAPI hardware counters library is needed.
+*/
+
+#ifdef PROFILE_PAPI
+  USE_PAPI := on
+#else
+  USE_PAPI :=
+#endif
@@ -109,6 +109,22 @@ else()
   set( PIO_INCDIR "" )
 endif()
 
+# Locations of the PAPI hardware counters library. If PAPI_INCDIR and
+# PAPI_LIBDIR are not given, they are set from the PAPI_DIR root.
+#
+# The decision about whether to use it in linking is computed below.
+# This CMake setup will NOT build PAPI for you.
+
+if( NOT DEFINED PAPI_DIR )
+  set( PAPI_DIR "/usr/local/papi" )
+endif()
+if( NOT DEFINED PAPI_INCDIR )
+  set( PAPI_INCDIR "${PAPI_DIR}/include" )
+endif()
+if( NOT DEFINED PAPI_LIBDIR )
+  set( PAPI_LIBDIR "${PAPI_DIR}/lib" )
+endif()
+
 set( ROMS_HEADER ${HEADER_DIR}/${ROMS_APP_HEADER} )
 
 add_compile_definitions( ROMS_HEADER="${ROMS_HEADER}" )
@@ -169,4 +185,11 @@ if( "${defs}" MATCHES "SCORPIO" )
   message( STATUS "ROMS Link With Parallel I/O Using SCORPIO ENABLED" )
 endif()
 
+if( "${defs}" MATCHES "PAPI" )
+  option( PAPI "PAPI Hardware Counters Library" ON )
+  message( STATUS "ROMS Link With PAPI Hardware Counters ENABLED" )
+  message( STATUS "   PAPI_LIBDIR = ${PAPI_LIBDIR}" )
+  message( STATUS "   PAPI_INCDIR = ${PAPI_INCDIR}" )
+endif()
+
 
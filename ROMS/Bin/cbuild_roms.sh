@@ -414,6 +414,12 @@ else
   arpack_ldir=""
 fi
 
+if [ ! -z "${PAPI_DIR}" ]; then
+  papi_dir="-DPAPI_DIR=${PAPI_DIR}"
+else
+  papi_dir=""
+fi
+
 if [ ! -z "${USE_SCORPIO}" ]; then
   if [[ ! -z "${PIO_LIBDIR}" && ! -z "${PIO_INCDIR}" ]]; then
     pio_ldir="-DPIO_LIBDIR=${PIO_LIBDIR}"
@@ -478,6 +484,7 @@ if [[ $dprint -eq 0 && $clean -eq 1 ]]; then
                    ${extra_flags} \
                    ${parpack_ldir} \
                    ${arpack_ldir} \
+                   ${papi_dir} \
                    ${pio_ldir} \
                    ${pio_idir} \
                    ${pnetcdf_ldir} \
@@ -199,6 +199,15 @@
 # endif
       END DO
 #endif
+#ifdef OFFLINE_FLOATS
+!
+!  Activate processing of the stored solution forward trajectory files
+!  replayed by the offline floats.
+!
+      DO ng=1,Ngrids
+        LreadFWD(ng)=.TRUE.
+      END DO
+#endif
 !
 !-----------------------------------------------------------------------
 !  Initialize nonlinear model state variables over all nested grids,
@@ -302,7 +311,9 @@
       IF (Master) WRITE (stdout,'(1x)')
 !
 !$OMP PARALLEL
-#ifdef SOLVE3D
+#if defined OFFLINE_FLOATS
+      CALL main3d_offline (MyRunInterval)
+#elif defined SOLVE3D
       CALL main3d (MyRunInterval)
 #else
       CALL main2d (MyRunInterval)
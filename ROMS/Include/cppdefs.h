@@ -146,6 +146,8 @@
 ** MASKING                 if land/sea masking                               **
 ** BODYFORCE               if applying stresses as bodyforces                **
 ** PROFILE                 if time profiling                                 **
+** PROFILE_PAPI            if hardware counters profiling (PAPI library)     **
+** PROFILE_CSV             if writing per-node region times into CSV file    **
 ** AVERAGES                if writing out NLM time-averaged data             **
 ** AVERAGES_DETIDE         if writing out NLM time-averaged detided fields   **
 ** AD_AVERAGES             if writing out ADM time-averaged data             **
@@ -159,13 +161,16 @@
 ** SPHERICAL               if analytical spherical grid                      **
 ** STATIONS                if writing out station data                       **
 ** STATIONS_CGRID          if extracting data at native C-grid               **
+** SUBREGION_OUTPUT        if writing out sub-region boxes and transects     **
 **                                                                           **
 ** OPTIONS for Lagrangian drifters:                                          **
 **                                                                           **
 ** FLOATS                  to activate simulated Lagrangian drifters         **
+** FLOAT_OWNERSHIP         if floats stored only in their owner node tile    **
 ** FLOAT_OYSTER            to activate oyster model behavior in floats       **
 ** FLOAT_STICKY            to reflect/stick floats that hit surface/bottom   **
 ** FLOAT_VWALK             if vertical random walk                           **
+** OFFLINE_FLOATS          if floats advected by stored 3D solution (FWD)    **
 ** VWALK_FORWARD           if forward time stepping vertical random walk     **
 **                                                                           **
 ** OPTIONS for analytical fields configuration:                              **
@@ -595,12 +600,40 @@
 ** REDUCE_ALLGATHER    use "mpi_allgather" in "mp_reduce"                    **
 ** REDUCE_ALLREDUCE    use "mpi_allreduce" in "mp_reduce"                    **
 **                                                                           **
+** The global sums of floating-point values depend on the order of the       **
+** additions, so they change with the tile partition and number of nodes.    **
+** Alternatively, the domain-integrated diagnostics and the state vectors    **
+** dot products can be accumulated exactly in integer arithmetic, so they    **
+** are bitwise reproducible for any partition:                               **
+**                                                                           **
+** REPRO_SUM           use reproducible sums in "diag" and "state_dotprod"   **
+**                                                                           **
+** The halo exchanges in "mp_exchange" post new point-to-point messages and  **
+** use automatic (stack) communication buffers on every call. Alternatively, **
+** persistent MPI requests ("mpi_send_init" and "mpi_recv_init") and heap    **
+** buffers can be created once for each message size and reused:             **
+**                                                                           **
+** PERSISTENT_EXCHANGE use persistent requests in "mp_exchange2d/3d/4d"      **
+**                                                                           **
+** The tile partition splits each grid uniformly into NtileI x NtileJ        **
+** tiles, so tiles with a lot of land have less work. Alternatively, the     **
+** tile columns and rows can have variable widths set from "mask_rho" in     **
+** the grid file, so all tiles have about the same number of wet points.     **
+** All-land tiles are only reported; they still get an MPI rank:             **
+**                                                                           **
+** BALANCED_TILES      use wet-point balanced tile partition widths          **
+**                                                                           **
 ** NetCDF input/output OPTIONS:                                              **
 **                                                                           **
+** ASYNCHRONOUS_PIO        if PIO output drained by dedicated I/O processes  **
+** ASYNCHRONOUS_SCORPIO    if SCORPIO output by dedicated I/O processes      **
+**                         (both need PIO_LIB; no asynchronous output server **
+**                         is provided for the serial NetCDF I/O)            **
 ** CHECKSUM                to report checksum when processing I/O            **
 ** CHECK_OPEN_FILES        to report number opened/closed/created files      **
 ** DEFLATE                 to set compression NetCDF-4/HDF5 format files     **
 ** HDF5                    to create NetCDF-4/HDF5 format files              **
+** INSITU_ANALYSIS         if in-situ analysis plugin at output stage        **
 ** METADATA_REPORT         to report/dump YAML metadata dictionary           **
 ** NO_LBC_ATT              to not check NLM_LBC global attribute on restart  **
 ** NO_READ_GHOST           to not include ghost points during read/scatter   **
@@ -612,10 +645,13 @@
 ** PIO_LIB                 to include Parallel-IO from the PIO library       **
 ** PNETCDF                 if parallel I/O with pnetcdf (classic format)     **
 ** POSITIVE_ZERO           to impose positive zero in ouput data             **
+** PREFETCH_INPUT          if reading ahead next record of gridded input     **
 ** READ_WATER              if only reading water points data                 **
 ** REGRID_SHAPIRO          to apply Shapiro Filter to regridded data         **
 ** ROMS_STDOUT             to write standard output into the 'log.roms' file **
+** RST_NATIVE              if native binary perfect restart files per node   **
 ** RST_SINGLE              if writing single precision restart fields        **
+** TILED_READ              if each node reads its own tile from input files  **
 ** WRITE_WATER             if only writing water points data                 **
 **                                                                           **
 ** OPTION to process 3D data by levels (2D slabs) to reduce memory needs in  **
@@ -184,6 +184,33 @@
 # endif
 #endif
 
+/*
+** Tiled input reading is only needed in distributed-memory applications
+** using serial NetCDF I/O (PARALLEL_IO already reads tile sections).
+*/
+
+#if defined TILED_READ && (defined PARALLEL_IO || !defined DISTRIBUTE)
+# undef TILED_READ
+#endif
+
+/*
+** Wet-point balanced tile partitions are only available in
+** distributed-memory applications.
+*/
+
+#if defined BALANCED_TILES && !defined DISTRIBUTE
+# undef BALANCED_TILES
+#endif
+
+/*
+** Native binary restart files only include the perfect restart state
+** of the ocean, mixing, and sediment kernels.
+*/
+
+#if defined RST_NATIVE && (!defined PERFECT_RESTART || defined ICE_MODEL)
+# undef RST_NATIVE
+#endif
+
 /*
 ** Remove OpenMP directives in serial and distributed memory
 ** Applications.  This definition will be used in conjunction with
@@ -816,6 +843,36 @@
 # define FLOAT_BIOLOGY
 #endif
 
+/*
+** Floats ownership is only available in distributed-memory
+** applications. It is not available in the tangent linear and adjoint
+** based drivers since their initialization routines, which may be
+** called again after the floats are distributed to the owner nodes,
+** index the DRIFTER arrays by the global float number.
+*/
+
+#if defined FLOAT_OWNERSHIP && \
+    (!(defined FLOATS && defined DISTRIBUTE) || \
+     defined TANGENT || defined TL_IOMS || defined ADJOINT)
+# undef FLOAT_OWNERSHIP
+#endif
+
+/*
+** Offline floats replay a stored 3D nonlinear solution read from the
+** forward trajectory (FWDNAME) files. It is not available in the
+** tangent linear and adjoint based drivers.
+*/
+
+#if defined OFFLINE_FLOATS && \
+    (!(defined FLOATS && defined SOLVE3D) || \
+     defined TANGENT || defined TL_IOMS || defined ADJOINT)
+# undef OFFLINE_FLOATS
+#endif
+
+#if defined OFFLINE_FLOATS && !defined FORWARD_READ
+# define FORWARD_READ
+#endif
+
 /*
 ** Define internal option to couple to other models.
 **
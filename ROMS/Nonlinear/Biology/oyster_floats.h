@@ -146,11 +146,11 @@
       real(r8), intent(in) :: Tinfo(0:,:)
       real(r8), intent(inout) :: track(:,0:,:)
 #else
-      logical, intent(in) :: bounded(Nfloats(ng))
+      logical, intent(in) :: bounded(Fslots(ng))
       logical, intent(in) :: my_thread(Lstr:Lend)
 
-      real(r8), intent(in) :: Tinfo(0:izrhs,Nfloats(ng))
-      real(r8), intent(inout) :: track(NFV(ng),0:NFT,Nfloats(ng))
+      real(r8), intent(in) :: Tinfo(0:izrhs,Fslots(ng))
+      real(r8), intent(inout) :: track(NFV(ng),0:NFT,Fslots(ng))
 #endif
 !
 !  Local variable declarations.
@@ -258,6 +258,8 @@
       USE exchange_2d_mod
 #ifdef DISTRIBUTE
       USE mp_exchange_mod, ONLY : mp_exchange2d
+      USE mp_exchange_mod, ONLY : mp_exchange2d_start,                  &
+     &                            mp_exchange2d_finish, T_XCHG
 #endif
       USE obc_volcons_mod, ONLY : obc_flux_tile, set_DUV_bc_tile
       USE u2dbc_mod,       ONLY : u2dbc_tile
@@ -557,6 +559,10 @@
       real(r8) :: cff, cff1, cff2, cff3, cff4, cff5, cff6, cff7
       real(r8) :: fac, fac1, fac2, fac3
 !
+#ifdef DISTRIBUTE
+      TYPE (T_XCHG) :: Xrzeta, Xzeta
+!
+#endif
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: Dgrad
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: Dnew
       real(r8), dimension(IminS:ImaxS,JminS:JmaxS) :: Drhs
@@ -1010,11 +1016,17 @@
      &                            rzeta(:,:,krhs))
         END IF
 #ifdef DISTRIBUTE
-        CALL mp_exchange2d (ng, tile, iNLM, 1,                          &
-     &                      LBi, UBi, LBj, UBj,                         &
-     &                      NghostPoints,                               &
-     &                      EWperiodic(ng), NSperiodic(ng),             &
-     &                      rzeta(:,:,krhs))
+!
+!  Start the exchange of the free-surface right-hand-side term. It is
+!  not needed in the rest of this routine, so it is completed together
+!  with the free-surface exchange below.
+!
+        CALL mp_exchange2d_start (ng, tile, iNLM, 1,                    &
+     &                            LBi, UBi, LBj, UBj,                   &
+     &                            NghostPoints,                         &
+     &                            EWperiodic(ng), NSperiodic(ng),       &
+     &                            Xrzeta,                               &
+     &                            rzeta(:,:,krhs))
 #endif
       END IF
 !
@@ -1065,11 +1077,19 @@
      &                          zeta(:,:,knew))
       END IF
 #ifdef DISTRIBUTE
-      CALL mp_exchange2d (ng, tile, iNLM, 1,                            &
-     &                    LBi, UBi, LBj, UBj,                           &
-     &                    NghostPoints,                                 &
-     &                    EWperiodic(ng), NSperiodic(ng),               &
-     &                    zeta(:,:,knew))
+!
+!  Start the exchange of the new free-surface. The right-hand-side
+!  terms of the 2D momentum equations below only use tile interior
+!  values of "zeta(:,:,knew)", so the communication overlaps with
+!  their computation. The exchange is completed before applying the
+!  lateral boundary conditions.
+!
+      CALL mp_exchange2d_start (ng, tile, iNLM, 1,                      &
+     &                          LBi, UBi, LBj, UBj,                     &
+     &                          NghostPoints,                           &
+     &                          EWperiodic(ng), NSperiodic(ng),         &
+     &                          Xzeta,                                  &
+     &                          zeta(:,:,knew))
 #endif
 !
 !=======================================================================
@@ -2863,6 +2883,27 @@
         END DO
 #endif
       END IF
+#ifdef DISTRIBUTE
+!
+!-----------------------------------------------------------------------
+!  Complete the free-surface exchanges started above.
+!-----------------------------------------------------------------------
+!
+      IF (PREDICTOR_2D_STEP(ng)) THEN
+        CALL mp_exchange2d_finish (ng, tile, iNLM, 1,                   &
+     &                             LBi, UBi, LBj, UBj,                  &
+     &                             NghostPoints,                        &
+     &                             EWperiodic(ng), NSperiodic(ng),      &
+     &                             Xrzeta,                              &
+     &                             rzeta(:,:,krhs))
+      END IF
+      CALL mp_exchange2d_finish (ng, tile, iNLM, 1,                     &
+     &                           LBi, UBi, LBj, UBj,                    &
+     &                           NghostPoints,                          &
+     &                           EWperiodic(ng), NSperiodic(ng),        &
+     &                           Xzeta,                                 &
+     &                           zeta(:,:,knew))
+#endif
 !
 !-----------------------------------------------------------------------
 !  Apply lateral boundary conditions.
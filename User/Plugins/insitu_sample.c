@@ -0,0 +1,135 @@
+/*
+** git $Id$
+**:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+** Copyright (c) 2002-2024 The ROMS/TOMS Group                          :::
+**   Licensed under a MIT/X style license                               :::
+**   See License_ROMS.md                                                :::
+**:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+**                                                                      :::
+** Sample in-situ analysis plugin (INSITU_ANALYSIS option).             :::
+**                                                                      :::
+** Every INSITU_NSTEP time-steps (default 1), each node writes a line   :::
+** to "insitu_NNNN.txt" with derived surface and bottom products of     :::
+** its tile interior: mean surface temperature, maximum surface speed,  :::
+** mean bottom temperature, and mean surface boundary layer depth.      :::
+** The model arrays are read in place; nothing is copied.               :::
+**                                                                      :::
+** Build and run:                                                       :::
+**                                                                      :::
+**   cc -O2 -shared -fPIC -o libinsitu.so insitu_sample.c               :::
+**   export ROMS_INSITU_PLUGIN=$PWD/libinsitu.so                        :::
+**                                                                      :::
+** A Python plugin can export the same two C functions with the cffi    :::
+** embedding API (ffi.embedding_api/ffi.compile) and use numpy to wrap  :::
+** the data pointers without copying.                                   :::
+**:::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+** Interoperable structures, see "ROMS/Utility/insitu.F".
+*/
+
+typedef struct {
+  int ng, rank, nranks, step;
+  int Istr, Iend, Jstr, Jend;
+  int N, nview;
+  double time;
+} T_INSITU_INFO;
+
+typedef struct {
+  char name[16];
+  int gtype, ndims;
+  int lbound[3], ubound[3];
+  const double *data;
+} T_INSITU_VIEW;
+
+static FILE *out = NULL;
+static int nstep = 1;
+
+/*
+** Find view by name.
+*/
+
+static const T_INSITU_VIEW *find_view (const T_INSITU_INFO *info,
+                                       const T_INSITU_VIEW *view,
+                                       const char *name)
+{
+  int n;
+
+  for (n = 0; n < info->nview; n++)
+    if (strcmp(view[n].name, name) == 0) return &view[n];
+  return NULL;
+}
+
+/*
+** Value at Fortran indices (i,j,k) of a view.
+*/
+
+static double at (const T_INSITU_VIEW *v, int i, int j, int k)
+{
+  long ni = v->ubound[0] - v->lbound[0] + 1;
+  long nj = v->ubound[1] - v->lbound[1] + 1;
+
+  return v->data[(i - v->lbound[0]) +
+                 (j - v->lbound[1]) * ni +
+                 (k - v->lbound[2]) * ni * nj];
+}
+
+int roms_insitu_init (int ng, int rank, int nranks, int comm)
+{
+  char fname[32];
+  const char *env = getenv("INSITU_NSTEP");
+
+  if (env != NULL && atoi(env) > 0) nstep = atoi(env);
+  if (out == NULL) {
+    snprintf(fname, sizeof(fname), "insitu_%04d.txt", rank);
+    out = fopen(fname, "w");
+    if (out == NULL) return 1;
+    fprintf(out, "# grid  step  time(s)  SST  max_speed  Tbot  Hsbl\n");
+  }
+  return 0;
+}
+
+int roms_insitu_step (const T_INSITU_INFO *info,
+                      const T_INSITU_VIEW *view)
+{
+  const T_INSITU_VIEW *temp = find_view(info, view, "temp");
+  const T_INSITU_VIEW *u = find_view(info, view, "u");
+  const T_INSITU_VIEW *v = find_view(info, view, "v");
+  const T_INSITU_VIEW *mask = find_view(info, view, "mask_rho");
+  const T_INSITU_VIEW *hsbl = find_view(info, view, "Hsbl");
+  double area = 0.0, sst = 0.0, tbot = 0.0, mld = 0.0, umax = 0.0;
+  double m, us, vs;
+  int i, j, N = info->N;
+
+  if (out == NULL || (info->step - 1) % nstep != 0) return 0;
+  if (temp == NULL || u == NULL || v == NULL) return 0;
+
+  for (j = info->Jstr; j <= info->Jend; j++) {
+    for (i = info->Istr; i <= info->Iend; i++) {
+      m = (mask != NULL) ? at(mask, i, j, 1) : 1.0;
+      if (m == 0.0) continue;
+      area += 1.0;
+      sst += at(temp, i, j, N);
+      tbot += at(temp, i, j, 1);
+      if (hsbl != NULL) mld += at(hsbl, i, j, 1);
+      us = 0.5 * (at(u, i, j, N) + at(u, i + 1, j, N));
+      vs = 0.5 * (at(v, i, j, N) + at(v, i, j + 1, N));
+      umax = fmax(umax, sqrt(us * us + vs * vs));
+    }
+  }
+  if (area > 0.0) {
+    sst /= area;
+    tbot /= area;
+    mld /= area;
+  }
+  fprintf(out, "%3d %10d %16.4f %12.6f %12.6f %12.6f %12.4f\n",
+          info->ng, info->step, info->time, sst, umax, tbot, mld);
+  fflush(out);
+  return 0;
+}